@@ -0,0 +1,40 @@
+// Build-time helper: decode a PNG into raw RGBA pixels and emit a C header,
+// so the executable can hand the icon straight to SetWindowIcon() without
+// running the PNG decoder on every launch.
+//
+// Usage: icon2rgba <input.png> <symbol> > header.h
+
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_ONLY_PNG
+#include "stb_image.h"
+
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  if (argc != 3) {
+    fprintf(stderr, "Usage: %s <input.png> <symbol>\n", argv[0]);
+    return 1;
+  }
+
+  int width, height, channels;
+  unsigned char *pixels = stbi_load(argv[1], &width, &height, &channels, 4);
+  if (pixels == NULL) {
+    fprintf(stderr, "Cannot decode %s: %s\n", argv[1], stbi_failure_reason());
+    return 1;
+  }
+
+  // Same layout as `xxd -i`, plus the image dimensions
+  unsigned int len = (unsigned int)width * (unsigned int)height * 4;
+  printf("unsigned int %s_width = %d;\n", argv[2], width);
+  printf("unsigned int %s_height = %d;\n", argv[2], height);
+  printf("unsigned char %s[] = {\n", argv[2]);
+  for (unsigned int i = 0; i < len; i++) {
+    printf("%s0x%02x%s", (i % 12 == 0) ? "  " : " ", pixels[i],
+           (i + 1 == len) ? "\n" : ((i % 12 == 11) ? ",\n" : ","));
+  }
+  printf("};\n");
+  printf("unsigned int %s_len = %u;\n", argv[2], len);
+
+  stbi_image_free(pixels);
+  return 0;
+}
@@ -1,114 +0,0 @@
-unsigned char idleclicker_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x32,
-  0x08, 0x06, 0x00, 0x00, 0x00, 0x1e, 0x3f, 0x88, 0xb1, 0x00, 0x00, 0x00,
-  0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x0b,
-  0x13, 0x01, 0x00, 0x9a, 0x9c, 0x18, 0x00, 0x00, 0x04, 0xe0, 0x49, 0x44,
-  0x41, 0x54, 0x78, 0x9c, 0xed, 0x99, 0x7d, 0x48, 0xab, 0x55, 0x1c, 0xc7,
-  0xbf, 0xdb, 0x14, 0xb6, 0x84, 0xbd, 0xa5, 0x73, 0xbd, 0x88, 0xa3, 0xc2,
-  0x29, 0xea, 0xc0, 0x4c, 0x6f, 0xde, 0x6b, 0xf7, 0x46, 0xa1, 0x81, 0x12,
-  0x4a, 0x66, 0x92, 0x88, 0x04, 0x09, 0x46, 0x04, 0x49, 0xda, 0x44, 0x25,
-  0xaf, 0x8a, 0x49, 0x61, 0x2a, 0x98, 0xa2, 0x26, 0x62, 0xa4, 0x54, 0x26,
-  0x42, 0xfe, 0x91, 0x65, 0x92, 0x1a, 0xe2, 0x7c, 0x41, 0x0d, 0xd4, 0x10,
-  0xa3, 0xdd, 0xf0, 0x85, 0xa1, 0xec, 0x8f, 0x7c, 0xd9, 0xee, 0x75, 0xbe,
-  0xec, 0xc4, 0xef, 0xb9, 0x33, 0x74, 0x57, 0xe7, 0xbd, 0xb9, 0xe9, 0xb3,
-  0xb8, 0x1f, 0xd8, 0x1f, 0xe7, 0x3c, 0xdb, 0xb3, 0xdf, 0x87, 0x73, 0x9e,
-  0xe7, 0xfc, 0xce, 0xef, 0x00, 0x0f, 0xf9, 0x7f, 0xa2, 0x03, 0xf0, 0x1e,
-  0x80, 0x8f, 0x01, 0xdc, 0x04, 0x90, 0x05, 0xc0, 0x1f, 0x5e, 0xc4, 0xcb,
-  0x00, 0x66, 0xa2, 0xa3, 0xa3, 0x59, 0x51, 0x51, 0x11, 0x6b, 0x68, 0x68,
-  0x60, 0xb5, 0xb5, 0xb5, 0x2c, 0x27, 0x27, 0x87, 0xa9, 0xd5, 0xea, 0x7d,
-  0x00, 0xed, 0x00, 0x1e, 0x07, 0xcf, 0x29, 0x0e, 0x0d, 0x0d, 0xb5, 0x0f,
-  0x0f, 0x0f, 0xb3, 0x93, 0xb0, 0xd9, 0x6c, 0xac, 0xa6, 0xa6, 0x86, 0x89,
-  0xc5, 0xe2, 0x75, 0x00, 0x57, 0xc0, 0x53, 0xde, 0x8d, 0x8b, 0x8b, 0x63,
-  0x1b, 0x1b, 0x1b, 0x5c, 0xd0, 0x73, 0x73, 0x73, 0x2c, 0x3f, 0x3f, 0x9f,
-  0x25, 0x27, 0x27, 0xb3, 0xb4, 0xb4, 0x34, 0x56, 0x57, 0x57, 0xc7, 0x36,
-  0x37, 0x37, 0xb9, 0x6b, 0xa3, 0xa3, 0xa3, 0xcc, 0xcf, 0xcf, 0xef, 0x6f,
-  0x00, 0xcf, 0x80, 0x67, 0x04, 0x07, 0x04, 0x04, 0xd8, 0xd6, 0xd6, 0xd6,
-  0xb8, 0x40, 0xcb, 0xcb, 0xcb, 0x99, 0x50, 0x28, 0xbc, 0x05, 0xe0, 0x7d,
-  0x00, 0xf1, 0x00, 0x5e, 0x01, 0x50, 0x1f, 0x18, 0x18, 0xb8, 0x4b, 0x12,
-  0x44, 0x67, 0x67, 0x27, 0x03, 0xf0, 0x0b, 0x78, 0xc6, 0xe7, 0xf4, 0x1c,
-  0x10, 0xcd, 0xcd, 0xcd, 0x14, 0xe0, 0x08, 0x80, 0x27, 0x00, 0x94, 0x01,
-  0x18, 0x05, 0xf0, 0x23, 0x80, 0xd7, 0x68, 0x3a, 0x29, 0x14, 0x0a, 0xeb,
-  0xd2, 0xd2, 0x12, 0xb3, 0xdb, 0xed, 0x2c, 0x36, 0x36, 0x96, 0xbe, 0x7b,
-  0x0d, 0x7c, 0x41, 0x28, 0x14, 0xae, 0xae, 0xaf, 0xaf, 0x73, 0xcf, 0x80,
-  0xbf, 0xbf, 0xbf, 0x0d, 0xc0, 0xd3, 0x00, 0x7e, 0xcd, 0xcb, 0xcb, 0x63,
-  0xf3, 0xf3, 0xf3, 0x6c, 0x68, 0x68, 0x88, 0xc5, 0xc4, 0xc4, 0x50, 0xd0,
-  0xef, 0xd0, 0x28, 0xe5, 0xe6, 0xe6, 0x72, 0xd2, 0xf5, 0xf5, 0xf5, 0xd4,
-  0xf7, 0x19, 0x78, 0x82, 0x42, 0xa3, 0xd1, 0x70, 0x81, 0x8d, 0x8c, 0x8c,
-  0x50, 0x60, 0xfd, 0x00, 0x5e, 0x4a, 0x4a, 0x4a, 0x3a, 0xf6, 0xa0, 0xd3,
-  0xb4, 0x13, 0x89, 0x44, 0x26, 0x00, 0x8f, 0x06, 0x05, 0x05, 0x71, 0x7d,
-  0x63, 0x63, 0x63, 0xf4, 0xfd, 0x9f, 0xc0, 0x13, 0x9e, 0x8a, 0x8a, 0x8a,
-  0xe2, 0x02, 0xeb, 0xed, 0xed, 0xa5, 0xc0, 0xbe, 0x02, 0xf0, 0x41, 0x59,
-  0x59, 0xd9, 0x3d, 0x6f, 0x2d, 0xad, 0x56, 0x4b, 0xd7, 0x1f, 0x93, 0x48,
-  0x24, 0x3b, 0xd4, 0x5e, 0x5c, 0x5c, 0xa4, 0xf6, 0x24, 0x78, 0xc2, 0x23,
-  0x6a, 0xb5, 0xda, 0x4e, 0x81, 0xcd, 0xce, 0xce, 0x52, 0x60, 0x63, 0x00,
-  0xf4, 0x95, 0x95, 0x95, 0xf7, 0x88, 0xe8, 0x74, 0x3a, 0xba, 0x7e, 0x3d,
-  0x22, 0x22, 0x82, 0x6b, 0xd3, 0x94, 0x03, 0xf0, 0x3d, 0xf8, 0x82, 0x40,
-  0x20, 0xf8, 0xc3, 0x68, 0x34, 0xb2, 0x83, 0x83, 0x03, 0x16, 0x16, 0x16,
-  0x66, 0x07, 0xf0, 0x8d, 0x0b, 0x91, 0xaf, 0x4b, 0x4b, 0x4b, 0xb9, 0x76,
-  0x55, 0x55, 0x15, 0xb5, 0x2b, 0xc0, 0x23, 0x6e, 0x16, 0x17, 0x17, 0x73,
-  0xc1, 0xd1, 0x7a, 0x01, 0xc0, 0xe6, 0x42, 0xc4, 0x66, 0x32, 0x99, 0xd8,
-  0xde, 0xde, 0x1e, 0x0b, 0x09, 0x09, 0xa1, 0xb6, 0x16, 0x3c, 0xc2, 0x5f,
-  0x2c, 0x16, 0x9b, 0x17, 0x16, 0x16, 0x58, 0x4b, 0x4b, 0x0b, 0x05, 0xc7,
-  0x5c, 0x88, 0x70, 0x8b, 0xa6, 0x63, 0x34, 0x3a, 0xc1, 0x43, 0x52, 0x34,
-  0x1a, 0xcd, 0xbe, 0x5e, 0xaf, 0x3f, 0x53, 0xa4, 0xa9, 0xa9, 0x89, 0xf9,
-  0xf8, 0xf8, 0xfc, 0x45, 0x6f, 0x30, 0xf0, 0x94, 0xd7, 0x05, 0x02, 0xc1,
-  0x16, 0x80, 0xdf, 0x5c, 0x88, 0x4c, 0x0b, 0x04, 0x82, 0x79, 0x00, 0x4f,
-  0xc2, 0x0b, 0xd0, 0xbb, 0x10, 0x09, 0x86, 0x17, 0xa1, 0x3f, 0x43, 0x44,
-  0x0a, 0xe0, 0x2d, 0x00, 0x55, 0x34, 0x8a, 0x00, 0x44, 0xf0, 0x42, 0x91,
-  0x2b, 0x42, 0xa1, 0x70, 0x81, 0xd2, 0x94, 0xc6, 0xc6, 0x46, 0x96, 0x9a,
-  0x9a, 0x4a, 0x7d, 0x3f, 0x03, 0xf0, 0x75, 0xfc, 0xf6, 0x06, 0x80, 0x4f,
-  0x1d, 0xa9, 0x4b, 0x22, 0x9f, 0x45, 0xfa, 0xaa, 0xab, 0xab, 0x8f, 0xf5,
-  0x67, 0x65, 0x65, 0x1d, 0xe6, 0x61, 0xf9, 0x3a, 0x9d, 0xce, 0x4e, 0x89,
-  0x67, 0x6b, 0x6b, 0xeb, 0x61, 0x7e, 0xf6, 0x11, 0x5f, 0x45, 0x2c, 0xab,
-  0xab, 0xab, 0xc7, 0xfa, 0xfb, 0xfa, 0xfa, 0xb8, 0x94, 0x5e, 0xa5, 0x52,
-  0xd9, 0x0e, 0xf7, 0x2c, 0x84, 0xc5, 0x62, 0xa1, 0x5d, 0xe5, 0x2e, 0x00,
-  0x15, 0x00, 0xb5, 0x63, 0x94, 0x7e, 0x00, 0xd0, 0x08, 0x20, 0xfc, 0xb2,
-  0x45, 0xfe, 0xdd, 0x7c, 0x1d, 0x42, 0x3b, 0x4a, 0x00, 0x56, 0xda, 0x80,
-  0x39, 0x93, 0x92, 0x92, 0x42, 0xd7, 0xd2, 0x25, 0x12, 0xc9, 0x3a, 0x8d,
-  0x24, 0xed, 0x67, 0xda, 0xda, 0xda, 0x98, 0x4a, 0xa5, 0xba, 0x03, 0x20,
-  0x8a, 0x57, 0x22, 0x83, 0x83, 0x83, 0xd4, 0xbf, 0x4f, 0x53, 0xcc, 0x99,
-  0x8c, 0x8c, 0x0c, 0x2e, 0x7f, 0x73, 0x4e, 0x42, 0xbb, 0xba, 0xba, 0xa8,
-  0xbf, 0x8b, 0x57, 0x22, 0x03, 0x03, 0x03, 0x5c, 0xea, 0xe2, 0x42, 0x64,
-  0xab, 0xbf, 0xbf, 0xff, 0x58, 0x3f, 0x4d, 0x4f, 0x00, 0xbf, 0xbb, 0x23,
-  0x58, 0x9f, 0x07, 0x15, 0xa1, 0x55, 0x3f, 0x21, 0x21, 0x81, 0xdb, 0x1d,
-  0x1e, 0x65, 0x65, 0x65, 0x85, 0x85, 0x87, 0x87, 0xb3, 0xf6, 0xf6, 0xf6,
-  0xd3, 0x44, 0x76, 0x28, 0x53, 0x3e, 0x8a, 0xd9, 0x6c, 0xa6, 0xfe, 0x3f,
-  0xcf, 0x13, 0x7c, 0x09, 0x00, 0xa3, 0x52, 0xa9, 0xb4, 0x3b, 0x6e, 0xa4,
-  0x3f, 0x61, 0x1d, 0x38, 0x51, 0xe4, 0xbf, 0x90, 0x71, 0x57, 0xc4, 0xe6,
-  0x5c, 0x99, 0x39, 0xaf, 0x48, 0x6f, 0x76, 0x76, 0x36, 0xb7, 0xdb, 0x23,
-  0x28, 0x8b, 0xcd, 0xcc, 0xcc, 0x3c, 0x2c, 0x22, 0xf8, 0x79, 0x42, 0xa4,
-  0xa7, 0xa7, 0x87, 0x25, 0x26, 0x26, 0xb2, 0xed, 0xed, 0x6d, 0xb7, 0x89,
-  0xbc, 0x71, 0xd2, 0xb4, 0x20, 0x0a, 0x0b, 0x0b, 0xe9, 0xa6, 0x43, 0x47,
-  0x64, 0xdc, 0x26, 0x72, 0x1a, 0xe7, 0x11, 0x69, 0xed, 0xee, 0xee, 0x3e,
-  0xf5, 0xc6, 0x25, 0x25, 0x25, 0x47, 0x65, 0x78, 0x2d, 0xf2, 0x9d, 0xf3,
-  0x9b, 0xc3, 0x19, 0x47, 0x0a, 0x4f, 0x32, 0x65, 0x7c, 0x16, 0x29, 0x2c,
-  0x28, 0x28, 0x38, 0xf3, 0x0f, 0x1c, 0x32, 0x77, 0xf8, 0x2c, 0x22, 0xf5,
-  0xf5, 0xf5, 0x5d, 0xa6, 0x92, 0xcf, 0xfd, 0xc8, 0xf0, 0x59, 0x84, 0x88,
-  0x95, 0x4a, 0xa5, 0x5b, 0x06, 0x83, 0xe1, 0xcc, 0x3f, 0xa2, 0x62, 0x04,
-  0x9f, 0x45, 0x88, 0xe7, 0xa5, 0x52, 0xe9, 0x36, 0x15, 0xd7, 0x2e, 0x13,
-  0xb3, 0x1b, 0x44, 0x88, 0xb8, 0xcb, 0x96, 0x31, 0xbb, 0x49, 0x84, 0x93,
-  0x91, 0xc9, 0x64, 0xdb, 0xe3, 0xe3, 0xe3, 0x5e, 0x2f, 0x42, 0x5c, 0x95,
-  0xc9, 0x64, 0x96, 0xcb, 0x90, 0x31, 0xbb, 0x59, 0x84, 0xb8, 0x26, 0x97,
-  0xcb, 0x2d, 0x93, 0x93, 0x93, 0x17, 0x2a, 0xb2, 0xbc, 0xbc, 0x4c, 0x22,
-  0xb3, 0x70, 0x33, 0xf1, 0x32, 0x99, 0xcc, 0x3a, 0x31, 0x31, 0x71, 0x61,
-  0x22, 0x06, 0x83, 0x81, 0x39, 0xce, 0x5d, 0xdc, 0xce, 0x0b, 0x74, 0x88,
-  0x33, 0x35, 0x35, 0x75, 0x21, 0x22, 0xf5, 0x1e, 0x3e, 0x5b, 0xb9, 0xae,
-  0x50, 0x28, 0x6e, 0x4f, 0x4f, 0x4f, 0x7b, 0x5c, 0x24, 0x3e, 0x3e, 0x9e,
-  0x44, 0xae, 0xc2, 0x83, 0xdc, 0x50, 0x2a, 0x95, 0xb7, 0x67, 0x66, 0x66,
-  0x3c, 0x26, 0xd1, 0x77, 0xb7, 0x58, 0x41, 0xe7, 0x2a, 0x02, 0x78, 0x98,
-  0x17, 0xe9, 0x6d, 0x46, 0x7b, 0x71, 0x77, 0x63, 0x32, 0x99, 0x58, 0x70,
-  0x70, 0xf0, 0x1e, 0x2d, 0xcc, 0xb8, 0x20, 0x9e, 0x15, 0x89, 0x44, 0xb7,
-  0x28, 0xbd, 0xdf, 0xdd, 0xdd, 0x75, 0x8b, 0x84, 0xd1, 0x68, 0x64, 0x91,
-  0x91, 0x91, 0xb4, 0x33, 0x7d, 0x1b, 0x17, 0x0c, 0x95, 0x46, 0xbf, 0xd4,
-  0x6a, 0xb5, 0xf6, 0x8e, 0x8e, 0x0e, 0xb6, 0xb3, 0xc3, 0x9d, 0xb8, 0x3d,
-  0x30, 0x56, 0xab, 0x95, 0x3b, 0x77, 0xa1, 0x51, 0x06, 0xf0, 0x26, 0x2e,
-  0x91, 0xe7, 0x00, 0x7c, 0xab, 0x54, 0x2a, 0x6d, 0x54, 0xbb, 0xaa, 0xa8,
-  0xa8, 0xe0, 0x8e, 0x16, 0xe8, 0x2c, 0xc5, 0xd5, 0x87, 0x32, 0xe8, 0xf4,
-  0xf4, 0x74, 0x26, 0x97, 0xcb, 0x77, 0x00, 0x7c, 0xc1, 0xa7, 0x02, 0x38,
-  0x8d, 0x50, 0x32, 0x95, 0x46, 0x01, 0x7c, 0x72, 0x1f, 0x9f, 0x0f, 0x01,
-  0xbc, 0xea, 0x54, 0x0f, 0x78, 0x08, 0xbc, 0x95, 0x7f, 0x00, 0x76, 0x5f,
-  0xdd, 0xa3, 0xd3, 0x25, 0xfa, 0x96, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45,
-  0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-unsigned int idleclicker_png_len = 1326;
@@ -1,12 +1,15 @@
 #include <pthread.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // Platform detection
 #ifdef __linux__
 #define PLATFORM_LINUX
 #include "platform_linux.h"
 #include <raylib.h>
+#include <time.h>
 #include <unistd.h>
 #elif defined(_WIN32)
 #ifndef PLATFORM_WINDOWS
@@ -19,7 +22,7 @@
 #include <raylib.h>
 #endif
 
-#include "icon_data.h"
+#include "icon_rgba.h"
 
 typedef struct {
   Rectangle rect;
@@ -69,6 +72,73 @@ void *g_clickMutex = &g_clickMutex_win;
 pthread_mutex_t g_clickMutex = PTHREAD_MUTEX_INITIALIZER;
 #endif
 
+// Low-power mode (--low-power): event-driven UI and coalesced clicker wakeups
+bool g_lowPower = false;
+bool g_uiReady = false;          // Guarded by g_clickMutex
+int g_timerToleranceMs = 5;      // --tolerance=MS, allowed click lateness
+
+// Provided by the GLFW backend compiled into libraylib; raylib has no wrapper
+void glfwPostEmptyEvent(void);
+
+// Startup tracing (--startup-trace): per-phase timings on stderr
+bool g_startupTrace = false;
+double g_startupStart = 0.0;
+
+// Monotonic clock in milliseconds, usable before raylib is initialized
+double monotonicMs() {
+#ifdef PLATFORM_WINDOWS
+  return windows_monotonic_ms();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+#endif
+}
+
+// Record the end of a main-thread phase and start the next one
+void startupTracePhase(const char *phase, double *phaseStart) {
+  double now = monotonicMs();
+  if (g_startupTrace) {
+    fprintf(stderr, "[startup] %-14s %8.2fms (at %8.2fms)\n", phase,
+            now - *phaseStart, now - g_startupStart);
+  }
+  *phaseStart = now;
+}
+
+// Record a point event; safe to call from the hotkey/clicker threads
+void startupTraceMark(const char *event) {
+  if (g_startupTrace) {
+    fprintf(stderr, "[startup] %-14s %10s (at %8.2fms)\n", event, "",
+            monotonicMs() - g_startupStart);
+  }
+}
+
+// Wake blocked threads after the click state or interval changed
+void clickStateChanged() {
+  if (!g_lowPower)
+    return;
+
+#if defined(PLATFORM_LINUX)
+  linux_lowpower_notify();
+#elif defined(PLATFORM_WINDOWS)
+  windows_lowpower_notify();
+#endif
+
+  // The UI sleeps in glfwWaitEvents() and must redraw the status label.
+  // Posting under the lock keeps it from racing CloseWindow().
+#ifdef PLATFORM_WINDOWS
+  windows_mutex_lock(&g_clickMutex_win);
+  if (g_uiReady)
+    glfwPostEmptyEvent();
+  windows_mutex_unlock(&g_clickMutex_win);
+#else
+  pthread_mutex_lock(&g_clickMutex);
+  if (g_uiReady)
+    glfwPostEmptyEvent();
+  pthread_mutex_unlock(&g_clickMutex);
+#endif
+}
+
 // Perform a mouse click at current cursor position
 void performClick() {
 #if defined(PLATFORM_LINUX)
@@ -148,19 +218,29 @@ void *clickerWorker(void *arg) {
   return NULL;
 }
 
-int main(void) {
-  InitWindow(300, 200, "Idle Clicker");
-
-  // Load icon from memory (embedded)
-  Image icon =
-      LoadImageFromMemory(".png", idleclicker_png, idleclicker_png_len);
-  if (icon.data != NULL) {
-    SetWindowIcon(icon);
-    UnloadImage(icon);
+int main(int argc, char **argv) {
+  g_startupStart = monotonicMs();
+  double phaseStart = g_startupStart;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--startup-trace") == 0) {
+      g_startupTrace = true;
+    } else if (strcmp(argv[i], "--low-power") == 0) {
+      g_lowPower = true;
+    } else if (strncmp(argv[i], "--tolerance=", 12) == 0) {
+      const char *value = argv[i] + 12;
+      char *end;
+      long tolerance = strtol(value, &end, 10);
+      if (end == value || *end != '\0' || tolerance < 0 || tolerance > 1000) {
+        fprintf(stderr,
+                "Invalid --tolerance value '%s' (0-1000ms), using %dms\n",
+                value, g_timerToleranceMs);
+      } else {
+        g_timerToleranceMs = (int)tolerance;
+      }
+    }
   }
 
-  SetTargetFPS(60);
-
   // State variables
   bool isClicking = false;
 
@@ -171,18 +251,39 @@ int main(void) {
   // Initialize critical section for Windows
   windows_mutex_init(&g_clickMutex_win);
 
+  // Low-power mode swaps the polling loops for blocking ones
+  void *(*hotkeyRoutine)(void *) = hotkeyListener;
+  void *(*clickerRoutine)(void *) = clickerWorker;
+  if (g_lowPower) {
+    hotkeyRoutine = windows_lowpower_hotkey_listener;
+    if (windows_lowpower_init()) {
+      clickerRoutine = windows_lowpower_clicker;
+    } else {
+      fprintf(stderr, "Falling back to the polling clicker\n");
+    }
+  }
+
   // Start hotkey listener thread (Windows)
-  windows_thread_t hotkeyThread = windows_thread_create(hotkeyListener, NULL);
+  windows_thread_t hotkeyThread = windows_thread_create(hotkeyRoutine, NULL);
   if (hotkeyThread == NULL) {
     fprintf(stderr, "Failed to create hotkey thread\n");
   }
 
   // Start clicker worker thread (Windows)
-  windows_thread_t clickerThread = windows_thread_create(clickerWorker, NULL);
+  windows_thread_t clickerThread = windows_thread_create(clickerRoutine, NULL);
   if (clickerThread == NULL) {
     fprintf(stderr, "Failed to create clicker thread\n");
   }
 #else
+#ifdef PLATFORM_LINUX
+  linux_init_threads();
+  bool lowPowerClicker =
+      g_lowPower && linux_lowpower_init(g_timerToleranceMs);
+  if (g_lowPower && !lowPowerClicker) {
+    fprintf(stderr, "Falling back to the polling clicker\n");
+  }
+#endif
+
   // Start hotkey listener thread (POSIX)
   pthread_t hotkeyThread;
   int thread_result = pthread_create(&hotkeyThread, NULL, hotkeyListener, NULL);
@@ -192,14 +293,32 @@ int main(void) {
   pthread_detach(hotkeyThread); // Detach so it cleans up automatically
 
   // Start clicker worker thread (POSIX)
+  void *(*clickerRoutine)(void *) = clickerWorker;
+#ifdef PLATFORM_LINUX
+  if (lowPowerClicker) {
+    clickerRoutine = linux_lowpower_clicker;
+  }
+#endif
   pthread_t clickerThread;
-  thread_result = pthread_create(&clickerThread, NULL, clickerWorker, NULL);
+  thread_result = pthread_create(&clickerThread, NULL, clickerRoutine, NULL);
   if (thread_result != 0) {
     fprintf(stderr, "Failed to create clicker thread: %d\n", thread_result);
   }
   pthread_detach(clickerThread);
 #endif
 
+  // Threads run before any UI setup so F8 is live as early as possible
+  startupTracePhase("threads", &phaseStart);
+
+  InitWindow(300, 200, "Idle Clicker");
+  startupTracePhase("window", &phaseStart);
+
+  // Icon pixels are decoded at build time (icon_rgba.h)
+  Image icon = {idleclicker_rgba, idleclicker_rgba_width,
+                idleclicker_rgba_height, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+  SetWindowIcon(icon);
+  startupTracePhase("icon", &phaseStart);
+
   // Define buttons
   Button minusBtn = {{20, 20, 30, 30}, "-", false, false};
   Button plusBtn = {{250, 20, 30, 30}, "+", false, false};
@@ -209,6 +328,8 @@ int main(void) {
   Rectangle statusArea = {20, 140, 100, 40};
   bool statusHovered = false;
 
+  bool firstFrame = true;
+
   while (!WindowShouldClose()) {
     Vector2 mousePos = GetMousePosition();
     bool mouseDown = IsMouseButtonDown(MOUSE_LEFT_BUTTON);
@@ -229,6 +350,7 @@ int main(void) {
 #else
       pthread_mutex_unlock(&g_clickMutex);
 #endif
+      clickStateChanged();
     }
 
     // Handle plus button
@@ -246,6 +368,7 @@ int main(void) {
 #else
       pthread_mutex_unlock(&g_clickMutex);
 #endif
+      clickStateChanged();
     }
 
     // Handle quit button
@@ -267,6 +390,7 @@ int main(void) {
 #else
       pthread_mutex_unlock(&g_clickMutex);
 #endif
+      clickStateChanged();
     }
 
     // Read shared state for drawing
@@ -316,8 +440,50 @@ int main(void) {
     DrawButton(&quitBtn, mousePos, mouseDown);
 
     EndDrawing();
+
+    if (firstFrame) {
+      startupTracePhase("first-frame", &phaseStart);
+      firstFrame = false;
+
+      // Limit the frame rate from here on; the first frame skips the limiter
+      // sleep so it is presented (and traced) as soon as it is drawn
+      SetTargetFPS(60);
+
+      // Enabled only after the first frame, so the first EndDrawing() doesn't
+      // block in glfwWaitEvents() before anything is on screen
+      if (g_lowPower) {
+        // Only redraw on input or when clickStateChanged() posts an event
+        EnableEventWaiting();
+#ifdef PLATFORM_WINDOWS
+        windows_mutex_lock(&g_clickMutex_win);
+        g_uiReady = true;
+        windows_mutex_unlock(&g_clickMutex_win);
+#else
+        pthread_mutex_lock(&g_clickMutex);
+        g_uiReady = true;
+        pthread_mutex_unlock(&g_clickMutex);
+#endif
+      }
+    }
   }
 
+#ifdef PLATFORM_LINUX
+  if (lowPowerClicker) {
+    linux_lowpower_report();
+  }
+#endif
+
+  // Stop the hotkey/clicker threads from touching GLFW while it shuts down
+#ifdef PLATFORM_WINDOWS
+  windows_mutex_lock(&g_clickMutex_win);
+  g_uiReady = false;
+  windows_mutex_unlock(&g_clickMutex_win);
+#else
+  pthread_mutex_lock(&g_clickMutex);
+  g_uiReady = false;
+  pthread_mutex_unlock(&g_clickMutex);
+#endif
+
   CloseWindow();
   return 0;
 }
\ No newline at end of file
@@ -1,19 +1,35 @@
 #ifdef __linux__
 
+#define _GNU_SOURCE // ppoll()
+
 #include <X11/Xlib.h>
 #include <X11/extensions/XInput2.h>
 #include <X11/extensions/XTest.h>
 #include <X11/keysym.h>
+#include <errno.h>
+#include <poll.h>
 #include <pthread.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/eventfd.h>
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#include <time.h>
 #include <unistd.h>
 
 // External reference to the clicking state
 extern bool *g_isClicking;
 extern pthread_mutex_t g_clickMutex;
+extern int g_clickInterval;
+extern void clickStateChanged();
+extern void startupTraceMark(const char *event);
+
+// Must be the first Xlib call in the process: the hotkey and clicker threads
+// start before raylib/GLFW opens its own display connection
+void linux_init_threads() { XInitThreads(); }
 
 void *linux_open_display() { return XOpenDisplay(NULL); }
 
@@ -100,6 +116,7 @@ void *linux_hotkey_listener(void *arg) {
   KeyCode f8_keycode = XKeysymToKeycode(display, XK_F8);
   printf("F8 hotkey listener active (XIInput2 events)\n");
   fflush(stdout);
+  startupTraceMark("hotkey-ready");
 
   bool f8_was_pressed = false;
 
@@ -124,6 +141,7 @@ void *linux_hotkey_listener(void *arg) {
             *g_isClicking = !(*g_isClicking);
           }
           pthread_mutex_unlock(&g_clickMutex);
+          clickStateChanged();
         }
 
         f8_was_pressed = f8_is_pressed;
@@ -137,4 +155,190 @@ void *linux_hotkey_listener(void *arg) {
   return NULL;
 }
 
+// Low-power mode state
+#define LOWPOWER_REPORT_NS (60ULL * 1000000000ULL) // Stats every minute
+
+static int lp_event_fd = -1;  // Wakes the clicker on state changes
+static int lp_tolerance_ms = 5;
+static pthread_mutex_t lp_stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t lp_last_wall_ns = 0;
+static struct rusage lp_last_usage;
+static uint64_t lp_max_lateness_ns = 0;
+static unsigned long lp_late_clicks = 0;
+static unsigned long lp_clicks = 0;
+
+static uint64_t lp_now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+// Mirrors the kernel's select_estimate_accuracy(): besides the timer slack, a
+// poll-family timeout may fire late by 0.1% of its length (0.2% when niced),
+// capped at 100ms
+static uint64_t lp_timeout_range_ns(uint64_t wait_ns, int divisor) {
+  uint64_t range = wait_ns / divisor;
+  return range > 100000000ULL ? 100000000ULL : range;
+}
+
+static double lp_timeval_sec(struct timeval tv) {
+  return tv.tv_sec + tv.tv_usec / 1000000.0;
+}
+
+// Returns false if the low-power clicker cannot run
+bool linux_lowpower_init(int tolerance_ms) {
+  lp_tolerance_ms = tolerance_ms;
+  lp_event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (lp_event_fd < 0) {
+    perror("eventfd");
+    return false;
+  }
+
+  pthread_mutex_lock(&lp_stats_mutex);
+  lp_last_wall_ns = lp_now_ns();
+  getrusage(RUSAGE_SELF, &lp_last_usage);
+  pthread_mutex_unlock(&lp_stats_mutex);
+  return true;
+}
+
+void linux_lowpower_notify() {
+  if (lp_event_fd >= 0) {
+    uint64_t one = 1;
+    // EAGAIN means the counter is saturated, so a wakeup is already pending
+    if (write(lp_event_fd, &one, sizeof(one)) < 0 && errno != EAGAIN) {
+      perror("eventfd write");
+    }
+  }
+}
+
+// Print wakeups/sec and CPU time/hour measured since the previous report.
+// Wakeups are the process's voluntary context switches (every thread that
+// blocked and was woken), so UI and hotkey threads count too.
+void linux_lowpower_report() {
+  struct rusage usage;
+
+  // Sample under the lock so concurrent reports stay ordered
+  pthread_mutex_lock(&lp_stats_mutex);
+  uint64_t now = lp_now_ns();
+  getrusage(RUSAGE_SELF, &usage);
+  double wall = (now - lp_last_wall_ns) / 1000000000.0;
+  if (wall > 0) {
+    long switches = usage.ru_nvcsw - lp_last_usage.ru_nvcsw;
+    double cpu = (lp_timeval_sec(usage.ru_utime) -
+                  lp_timeval_sec(lp_last_usage.ru_utime)) +
+                 (lp_timeval_sec(usage.ru_stime) -
+                  lp_timeval_sec(lp_last_usage.ru_stime));
+    fprintf(stderr,
+            "[low-power] %.2f wakeups/s, %.2fs CPU/h, %lu clicks, "
+            "max lateness %.2fms (%lu over %dms tolerance)\n",
+            switches / wall, cpu / wall * 3600.0, lp_clicks,
+            lp_max_lateness_ns / 1000000.0, lp_late_clicks, lp_tolerance_ms);
+  }
+  lp_last_wall_ns = now;
+  lp_last_usage = usage;
+  lp_max_lateness_ns = 0;
+  lp_late_clicks = 0;
+  lp_clicks = 0;
+  pthread_mutex_unlock(&lp_stats_mutex);
+}
+
+// Clicker worker for low-power mode. The click deadline is a ppoll() timeout,
+// state changes arrive on an eventfd, and the periodic stats report rides
+// along on click wakeups, so the thread blocks in exactly one wait and never
+// wakes while clicking is stopped except for the report.
+void *linux_lowpower_clicker(void *arg) {
+  // The tolerance is this thread's timer slack: the kernel may fire each click
+  // deadline up to that late so it can batch it with other wakeups. timerfd
+  // expirations ignore slack, hence the ppoll() timeout instead. A slack of 0
+  // would reset to the default (~50us), so --tolerance=0 asks for 1ns.
+  unsigned long slack_ns =
+      lp_tolerance_ms > 0 ? (unsigned long)lp_tolerance_ms * 1000000UL : 1;
+  prctl(PR_SET_TIMERSLACK, slack_ns, 0, 0, 0);
+  int range_divisor = getpriority(PRIO_PROCESS, 0) > 0 ? 500 : 1000;
+
+  Display *dpy = XOpenDisplay(NULL);
+  if (dpy == NULL) {
+    fprintf(stderr, "Cannot open display for clicker\n");
+    return NULL;
+  }
+
+  uint64_t tolerance_ns = (uint64_t)lp_tolerance_ms * 1000000ULL;
+  uint64_t next_report = lp_now_ns() + LOWPOWER_REPORT_NS;
+  uint64_t due = 0; // Next click deadline, 0 while stopped
+
+  while (1) {
+    bool clicking = false;
+    int interval = 200;
+
+    pthread_mutex_lock(&g_clickMutex);
+    if (g_isClicking)
+      clicking = *g_isClicking;
+    interval = g_clickInterval;
+    pthread_mutex_unlock(&g_clickMutex);
+
+    uint64_t now = lp_now_ns();
+    uint64_t interval_ns = (uint64_t)interval * 1000000ULL;
+
+    if (!clicking) {
+      due = 0;
+    } else if (due == 0) {
+      due = now; // Click immediately when switched on
+    } else if (due > now + interval_ns) {
+      due = now + interval_ns; // Interval was shortened
+    }
+
+    if (due != 0 && now >= due) {
+      uint64_t lateness = now - due;
+      linux_fake_click(dpy);
+
+      pthread_mutex_lock(&lp_stats_mutex);
+      lp_clicks++;
+      if (lateness > lp_max_lateness_ns)
+        lp_max_lateness_ns = lateness;
+      if (lateness > tolerance_ns)
+        lp_late_clicks++;
+      pthread_mutex_unlock(&lp_stats_mutex);
+
+      // Keep the cadence anchored to deadlines, but don't burst after a stall
+      due += interval_ns;
+      if (due <= now)
+        due = now + interval_ns;
+    }
+
+    if (now >= next_report) {
+      linux_lowpower_report();
+      next_report = now + LOWPOWER_REPORT_NS;
+    }
+
+    // While clicking, the report waits for the next click wakeup; while
+    // stopped, it is the only deadline
+    uint64_t deadline = due != 0 ? due : next_report;
+    now = lp_now_ns();
+    uint64_t wait_ns = deadline > now ? deadline - now : 0;
+
+    // On long click waits the kernel's proportional range can exceed the
+    // tolerance; wake that much earlier and wait out the short remainder on
+    // the next pass, so clicks are never early and at most tolerance late
+    if (due != 0) {
+      uint64_t range = lp_timeout_range_ns(wait_ns, range_divisor);
+      if (range > tolerance_ns)
+        wait_ns -= range - tolerance_ns;
+    }
+    struct timespec timeout = {wait_ns / 1000000000ULL,
+                               wait_ns % 1000000000ULL};
+
+    struct pollfd fds[1] = {{lp_event_fd, POLLIN, 0}};
+    if (ppoll(fds, 1, &timeout, NULL) > 0 && (fds[0].revents & POLLIN)) {
+      // Non-blocking drain; EAGAIN means another wakeup already consumed it
+      uint64_t count;
+      if (read(lp_event_fd, &count, sizeof(count)) < 0 && errno != EAGAIN) {
+        perror("eventfd read");
+      }
+    }
+  }
+
+  XCloseDisplay(dpy);
+  return NULL;
+}
+
 #endif // __linux__
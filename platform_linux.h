@@ -3,12 +3,22 @@
 
 #ifdef __linux__
 
+#include <stdbool.h>
+
 // Forward declarations to avoid including X11 headers in main file
+void linux_init_threads();
 void *linux_open_display();
 void linux_close_display(void *display);
 void linux_fake_click(void *display);
 void *linux_hotkey_listener(void *arg);
 
+// Low-power mode (--low-power): clicker blocking in a single ppoll() on an
+// eventfd, with the click deadline as its timeout
+bool linux_lowpower_init(int tolerance_ms);
+void linux_lowpower_notify();
+void linux_lowpower_report();
+void *linux_lowpower_clicker(void *arg);
+
 #endif
 
 #endif // PLATFORM_LINUX_H
@@ -7,6 +7,13 @@
 // External reference to the clicking state
 extern bool *g_isClicking;
 extern void *g_clickMutex; // CRITICAL_SECTION on Windows
+extern void startupTraceMark(const char *event);
+extern void clickStateChanged();
+extern int g_clickInterval;
+
+#ifndef MOD_NOREPEAT
+#define MOD_NOREPEAT 0x4000
+#endif
 
 void windows_fake_click() {
   INPUT inputs[2] = {0};
@@ -25,6 +32,7 @@ void windows_fake_click() {
 void *windows_hotkey_listener(void *arg) {
   printf("F8 hotkey listener active (GetAsyncKeyState polling)\n");
   fflush(stdout);
+  startupTraceMark("hotkey-ready");
 
   bool f8_was_pressed = false;
 
@@ -40,6 +48,7 @@ void *windows_hotkey_listener(void *arg) {
         *g_isClicking = !(*g_isClicking);
       }
       LeaveCriticalSection((CRITICAL_SECTION *)g_clickMutex);
+      clickStateChanged();
     }
 
     f8_was_pressed = f8_is_pressed;
@@ -66,9 +75,110 @@ void windows_mutex_unlock(CRITICAL_SECTION *mutex) {
 
 void windows_sleep(int ms) { Sleep(ms); }
 
+double windows_monotonic_ms() {
+  LARGE_INTEGER freq, now;
+  QueryPerformanceFrequency(&freq);
+  QueryPerformanceCounter(&now);
+  return (double)now.QuadPart * 1000.0 / (double)freq.QuadPart;
+}
+
 HANDLE windows_thread_create(void *(*start_routine)(void *), void *arg) {
   return CreateThread(NULL, 0, (LPTHREAD_START_ROUTINE)start_routine, arg, 0,
                       NULL);
 }
 
+// Low-power mode state
+static HANDLE lp_event = NULL; // Auto-reset, wakes the clicker on changes
+
+// Returns false if the low-power clicker cannot run
+bool windows_lowpower_init() {
+  lp_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+  if (lp_event == NULL) {
+    fprintf(stderr, "CreateEvent failed: %lu\n", GetLastError());
+    return false;
+  }
+  return true;
+}
+
+void windows_lowpower_notify() {
+  if (lp_event != NULL) {
+    SetEvent(lp_event);
+  }
+}
+
+// Blocks in GetMessage() until F8 is pressed instead of polling. Note that a
+// registered hotkey is not delivered to the focused application.
+void *windows_lowpower_hotkey_listener(void *arg) {
+  if (!RegisterHotKey(NULL, 1, MOD_NOREPEAT, VK_F8)) {
+    fprintf(stderr, "RegisterHotKey failed: %lu, falling back to polling\n",
+            GetLastError());
+    return windows_hotkey_listener(arg);
+  }
+
+  printf("F8 hotkey listener active (RegisterHotKey)\n");
+  fflush(stdout);
+  startupTraceMark("hotkey-ready");
+
+  MSG msg;
+  while (GetMessage(&msg, NULL, 0, 0) > 0) {
+    if (msg.message == WM_HOTKEY) {
+      // Toggle clicking state
+      EnterCriticalSection((CRITICAL_SECTION *)g_clickMutex);
+      if (g_isClicking != NULL) {
+        *g_isClicking = !(*g_isClicking);
+      }
+      LeaveCriticalSection((CRITICAL_SECTION *)g_clickMutex);
+      clickStateChanged();
+    }
+  }
+
+  UnregisterHotKey(NULL, 1);
+  return NULL;
+}
+
+// Clicker worker for low-power mode: waits on lp_event until the next click
+// deadline, or indefinitely while stopped
+void *windows_lowpower_clicker(void *arg) {
+  double due = 0; // Next click deadline, 0 while stopped
+
+  while (1) {
+    bool clicking = false;
+    int interval = 200;
+
+    EnterCriticalSection((CRITICAL_SECTION *)g_clickMutex);
+    if (g_isClicking)
+      clicking = *g_isClicking;
+    interval = g_clickInterval;
+    LeaveCriticalSection((CRITICAL_SECTION *)g_clickMutex);
+
+    double now = windows_monotonic_ms();
+
+    if (!clicking) {
+      due = 0;
+    } else if (due == 0) {
+      due = now; // Click immediately when switched on
+    } else if (due > now + interval) {
+      due = now + interval; // Interval was shortened
+    }
+
+    if (due != 0 && now >= due) {
+      windows_fake_click();
+
+      // Keep the cadence anchored to deadlines, but don't burst after a stall
+      due += interval;
+      if (due <= now)
+        due = now + interval;
+    }
+
+    DWORD timeout = INFINITE;
+    if (due != 0) {
+      now = windows_monotonic_ms();
+      timeout = due > now ? (DWORD)(due - now + 0.999) : 0;
+    }
+    WaitForSingleObject(lp_event, timeout);
+  }
+
+  return NULL;
+}
+
 #endif // _WIN32
@@ -21,12 +21,19 @@ typedef void *windows_thread_t;
 void windows_fake_click();
 void *windows_hotkey_listener(void *arg);
 
+// Low-power mode (--low-power): blocking hotkey and event-driven clicker
+bool windows_lowpower_init();
+void windows_lowpower_notify();
+void *windows_lowpower_hotkey_listener(void *arg);
+void *windows_lowpower_clicker(void *arg);
+
 // Wrapper functions for Windows threading (to avoid including windows.h in
 // main.c)
 void windows_mutex_init(windows_mutex_t *mutex);
 void windows_mutex_lock(windows_mutex_t *mutex);
 void windows_mutex_unlock(windows_mutex_t *mutex);
 void windows_sleep(int ms);
+double windows_monotonic_ms();
 windows_thread_t windows_thread_create(void *(*start_routine)(void *),
                                        void *arg);
 #endif